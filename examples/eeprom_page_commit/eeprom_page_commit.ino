@@ -0,0 +1,163 @@
+/***********************************************************
+This source file is licenced using the 3-Clause BSD License.
+
+Copyright (c) 2022 Acksen Ltd, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************/
+
+/*
+Example: 		eeprom_page_commit.ino
+Library:		AcksenIntEEPROM
+Author: 		Richard Phillips for Acksen Ltd
+
+Created:		    19 Oct 2026
+Last Modified:	19 Oct 2026
+
+Description:
+Demonstrate via debug serial port, Page Mode for targets where EEPROM is emulated in flash pages.
+A simulated page backend in RAM counts page erase/program cycles, showing that all writes between 
+begin() and commit() are combined into one cycle per changed page.
+
+*/
+
+#include <AcksenIntEEPROM.h>
+#include <string.h>
+
+// ***********************************
+// Serial Debug
+// ***********************************
+#define DEBUG_BAUD_RATE			115200
+
+// ***********************************
+// Constants
+// ***********************************
+#define EEPROM_SETTINGS							60	// Start Address for EEPROM data (spans the first two pages)
+#define SIM_PAGE_SIZE							64	// Simulated flash page size, in bytes
+#define SIM_PAGE_COUNT							4	// Simulated flash page count
+
+// ***********************************
+// Simulated Page Backend
+// ***********************************
+class SimulatedPageBackend : public AcksenIntEEPROMPageBackend
+{
+
+public:
+
+	SimulatedPageBackend()
+	{
+		memset(this->ucFlash, 0xFF, sizeof(this->ucFlash));	// Erased flash
+		this->uiPageCycles = 0;
+	}
+
+	unsigned int getPageSize() { return SIM_PAGE_SIZE; }
+	unsigned int getPageCount() { return SIM_PAGE_COUNT; }
+	uint8_t readByte(unsigned int uiAddress) { return this->ucFlash[uiAddress]; }
+
+	bool programPage(unsigned int uiPage, const uint8_t *pData)
+	{
+		memcpy(&this->ucFlash[uiPage * SIM_PAGE_SIZE], pData, SIM_PAGE_SIZE);
+		this->uiPageCycles++;
+		return true;
+	}
+
+	unsigned int uiPageCycles;	// Number of page erase/program cycles performed
+
+protected:
+
+	uint8_t ucFlash[SIM_PAGE_SIZE * SIM_PAGE_COUNT];
+
+};
+
+// ***********************************
+// Variables
+// ***********************************
+SimulatedPageBackend SimBackend;
+AcksenIntEEPROM IntEEPROM(EEPROM_SETTINGS);	// Initialise EEPROM library with defined start address
+
+// ************************************************
+// Setup 
+// ************************************************
+void setup()
+{
+
+	// Initialise Serial Port
+	Serial.begin(DEBUG_BAUD_RATE);
+	
+	// Start Page Mode using the simulated backend
+	if (IntEEPROM.begin(&SimBackend) == false)
+	{
+		Serial.println("Page Mode could not be started!");
+		while(1);
+	}
+	
+	Serial.println("Startup Complete!");
+	Serial.println("");
+ 
+}
+
+// ************************************************
+// Main Control Loop
+// ************************************************
+void loop()
+{
+
+	// Write several values, then commit them together
+	IntEEPROM.resetPresentAddress();	// Ensure that EEPROM Present Memory Address is reset to Starting Address
+
+	IntEEPROM.writeEEPROMValueBit(true);
+	IntEEPROM.writeEEPROMValueInt(34);
+	IntEEPROM.writeEEPROMValueLong(3423423);
+	IntEEPROM.writeEEPROMValueFloat(3.14159);
+	
+	IntEEPROM.commit();
+	
+	Serial.print("Page cycles after first commit (expected 2) = ");
+	Serial.println(SimBackend.uiPageCycles);
+
+	// Change a value and change it back again - the page contents are unchanged, so it is skipped
+	IntEEPROM.resetPresentAddress();
+	IntEEPROM.writeEEPROMValueBit(false);
+	IntEEPROM.resetPresentAddress();
+	IntEEPROM.writeEEPROMValueBit(true);
+	
+	IntEEPROM.commit();
+	
+	Serial.print("Page cycles after unchanged commit (expected 2) = ");
+	Serial.println(SimBackend.uiPageCycles);
+	
+	// Read Data back
+	IntEEPROM.resetPresentAddress();	// Ensure that EEPROM Present Memory Address is reset to Starting Address
+
+	Serial.println("");
+	Serial.println("EEPROM Read Test:");
+	Serial.println("******************");
+
+	Serial.print("Bool = ");
+	Serial.println(IntEEPROM.readEEPROMValueBit());
+	
+	Serial.print("Int = ");
+	Serial.println(IntEEPROM.readEEPROMValueInt());
+
+	Serial.print("Long = ");
+	Serial.println(IntEEPROM.readEEPROMValueLong());
+
+	Serial.print("Float = ");
+	Serial.println(IntEEPROM.readEEPROMValueFloat());
+	
+	Serial.println("");
+	
+	
+	
+	// Pause after single execution
+	while(1);
+	
+}
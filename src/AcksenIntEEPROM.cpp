@@ -17,6 +17,14 @@ common variable types, with validation options.
 AcksenIntEEPROM calls the EEPROMEx library by Thijs Elenbaas 
 (https://github.com/thijse/Arduino-EEPROMEx). 
 
+@section page_mode Page Mode
+
+On targets where EEPROM is emulated in flash, each write forces a whole page 
+to be erased and programmed.  Calling begin() with an AcksenIntEEPROMPageBackend 
+switches the library to Page Mode: all reads/writes use a RAM cache of the 
+emulated area, and commit() programs each changed page once.  Pages written 
+back to their original contents are skipped.
+
 @section dependencies Dependencies
 
 Requires the EEPROMEx library by Thijs Elenbaas
@@ -46,96 +54,290 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 */
 /***********************************************************/
 
-// Acksen Internal EEPROM Library v1.1.0
+// Acksen Internal EEPROM Library v1.2.0
 
 
 #include "Arduino.h"
 #include "AcksenIntEEPROM.h"
 
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
 AcksenIntEEPROM::AcksenIntEEPROM(int iStartAddress)
 {
 	
 	this->iEEPROMStartAddress = iStartAddress;
 	this->iEEPROMPresentAddress = iStartAddress;
 	
+	this->pPageBackend = NULL;
+	this->pPageCache = NULL;
+	this->pDirtyPages = NULL;
+	this->uiPageSize = 0;
+	this->uiPageCount = 0;
+	
+	this->bEEPROMError = false;
+	
 }
 
-bool AcksenIntEEPROM::writeEEPROMValueBit(bool bNewValue)
+AcksenIntEEPROM::~AcksenIntEEPROM()
 {
+	if (this->end() == false)
+	{
+		// Final commit failed - the pending writes cannot be retried, so release the cache anyway
+		free(this->pPageCache);
+		free(this->pDirtyPages);
+	}
+}
 
-	if (bNewValue != EEPROM.readBit(this->iEEPROMPresentAddress, 0))
+bool AcksenIntEEPROM::begin(AcksenIntEEPROMPageBackend *pBackend)
+{
+	unsigned int uiAddress;
+	unsigned int uiCacheSize;
+	
+	// Commit and release any previous Page Mode session, leaving it active if its pending writes could not be programmed
+	if (this->end() == false)
 	{
-		EEPROM.writeBit(this->iEEPROMPresentAddress, 0, bNewValue);
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_BYTE_SIZE;
-		return true;
+		return false;
 	}
-	else
+	
+	if (pBackend == NULL)
 	{
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_BYTE_SIZE;
+		// No backend
 		return false;
 	}
-
+	
+	this->uiPageSize = pBackend->getPageSize();
+	this->uiPageCount = pBackend->getPageCount();
+	
+	if ((this->uiPageSize == 0) || (this->uiPageCount == 0) || (this->uiPageCount > (UINT_MAX / this->uiPageSize)))
+	{
+		// Unusable page geometry
+		this->uiPageSize = 0;
+		this->uiPageCount = 0;
+		return false;
+	}
+	
+	uiCacheSize = this->uiPageSize * this->uiPageCount;
+	
+	this->pPageCache = (uint8_t *)malloc(uiCacheSize);
+	this->pDirtyPages = (uint8_t *)calloc((this->uiPageCount + 7) / 8, 1);
+	
+	if ((this->pPageCache == NULL) || (this->pDirtyPages == NULL))
+	{
+		// Allocation Error
+		free(this->pPageCache);
+		free(this->pDirtyPages);
+		this->pPageCache = NULL;
+		this->pDirtyPages = NULL;
+		this->uiPageSize = 0;
+		this->uiPageCount = 0;
+		return false;
+	}
+	
+	// Load the stored contents into the RAM cache
+	for (uiAddress = 0; uiAddress < uiCacheSize; uiAddress++)
+	{
+		this->pPageCache[uiAddress] = pBackend->readByte(uiAddress);
+	}
+	
+	this->pPageBackend = pBackend;
+	return true;
 }
 
-
-bool AcksenIntEEPROM::writeEEPROMValueInt(int iNewValue)
+bool AcksenIntEEPROM::commit()
 {
+	unsigned int uiPage;
+	unsigned int uiOffset;
+	unsigned int uiIndex;
+	bool bChanged;
+	bool bResult = true;
+	
+	if (this->pPageBackend == NULL)
+	{
+		// Page Mode not active
+		return false;
+	}
+	
+	for (uiPage = 0; uiPage < this->uiPageCount; uiPage++)
+	{
+		if ((this->pDirtyPages[uiPage / 8] & (1 << (uiPage % 8))) == 0)
+		{
+			// Not written since last commit
+			continue;
+		}
+		
+		// Only program the page if its contents differ from those stored, as values may have been written back to their original state
+		uiOffset = uiPage * this->uiPageSize;
+		bChanged = false;
+		
+		for (uiIndex = 0; uiIndex < this->uiPageSize; uiIndex++)
+		{
+			if (this->pPageCache[uiOffset + uiIndex] != this->pPageBackend->readByte(uiOffset + uiIndex))
+			{
+				bChanged = true;
+				break;
+			}
+		}
+		
+		if ((bChanged == true) && (this->pPageBackend->programPage(uiPage, &this->pPageCache[uiOffset]) == false))
+		{
+			// Programming Error - leave page pending for the next commit
+			bResult = false;
+			continue;
+		}
+		
+		this->pDirtyPages[uiPage / 8] &= ~(1 << (uiPage % 8));
+	}
+	
+	return bResult;
+}
 
-	if (iNewValue != EEPROM.readInt(this->iEEPROMPresentAddress))
+bool AcksenIntEEPROM::end()
+{
+	bool bResult;
+	
+	if (this->pPageBackend == NULL)
 	{
-		EEPROM.writeInt(this->iEEPROMPresentAddress, iNewValue);
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_INT_SIZE;
+		// Page Mode not active
 		return true;
 	}
-	else
+	
+	bResult = this->commit();
+	
+	if (bResult == false)
 	{
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_INT_SIZE;
+		// Programming Error - stay in Page Mode with the cache intact, so that the caller can retry
 		return false;
 	}
+	
+	free(this->pPageCache);
+	free(this->pDirtyPages);
+	this->pPageBackend = NULL;
+	this->pPageCache = NULL;
+	this->pDirtyPages = NULL;
+	this->uiPageSize = 0;
+	this->uiPageCount = 0;
+	
+	return true;
+}
 
-
+bool AcksenIntEEPROM::getError()
+{
+	return this->bEEPROMError;
 }
 
-bool AcksenIntEEPROM::writeEEPROMValueFloat( float fNewValue)
+void AcksenIntEEPROM::clearError()
 {
+	this->bEEPROMError = false;
+}
 
-	if (fNewValue != EEPROM.readFloat(this->iEEPROMPresentAddress))
+bool AcksenIntEEPROM::isPageCacheRange(int iAddress, int iSize)
+{
+	unsigned int uiCacheSize = this->uiPageSize * this->uiPageCount;
+	
+	// Checked in unsigned arithmetic, so that iAddress + iSize cannot overflow
+	if ((iAddress < 0) || (iSize < 0))
 	{
-		EEPROM.writeFloat(this->iEEPROMPresentAddress, fNewValue);
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_FLOAT_SIZE;
-		return true;
+		return false;
 	}
-	else
+	
+	return ((unsigned int)iAddress <= uiCacheSize) && ((unsigned int)iSize <= (uiCacheSize - (unsigned int)iAddress));
+}
+
+bool AcksenIntEEPROM::writePageCache(int iAddress, unsigned long ulValue, int iSize)
+{
+	bool bChanged = false;
+	unsigned int uiAddress;
+	uint8_t ucByte;
+	int iIndex;
+	
+	if (this->isPageCacheRange(iAddress, iSize) == false)
 	{
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_FLOAT_SIZE;
+		// Outside emulated EEPROM area
+		this->bEEPROMError = true;
 		return false;
 	}
-
+	
+	// Store least significant byte first, matching the AVR EEPROM layout
+	for (iIndex = 0; iIndex < iSize; iIndex++)
+	{
+		uiAddress = (unsigned int)iAddress + iIndex;
+		ucByte = (uint8_t)(ulValue >> (8 * iIndex));
+		
+		if (this->pPageCache[uiAddress] != ucByte)
+		{
+			this->pPageCache[uiAddress] = ucByte;
+			this->pDirtyPages[(uiAddress / this->uiPageSize) / 8] |= (1 << ((uiAddress / this->uiPageSize) % 8));
+			bChanged = true;
+		}
+	}
+	
+	return bChanged;
 }
 
-bool AcksenIntEEPROM::writeEEPROMValueLong(long lNewValue)
+unsigned long AcksenIntEEPROM::readPageCache(int iAddress, int iSize)
 {
-
-	if (lNewValue != EEPROM.readLong(this->iEEPROMPresentAddress))
+	unsigned long ulValue = 0;
+	int iIndex;
+	
+	if (this->isPageCacheRange(iAddress, iSize) == false)
 	{
-		EEPROM.writeLong(this->iEEPROMPresentAddress, lNewValue);
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_LONG_SIZE;
-		return true;
+		// Outside emulated EEPROM area
+		this->bEEPROMError = true;
+		return 0;
 	}
-	else
+	
+	for (iIndex = 0; iIndex < iSize; iIndex++)
 	{
-		this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_LONG_SIZE;
-		return false;
+		ulValue |= (unsigned long)this->pPageCache[iAddress + iIndex] << (8 * iIndex);
 	}
+	
+	return ulValue;
+}
 
+bool AcksenIntEEPROM::writeEEPROMValueBit(bool bNewValue)
+{
+	return this->writeEEPROMValueBitToAddress(&this->iEEPROMPresentAddress, bNewValue);
+}
+
+
+bool AcksenIntEEPROM::writeEEPROMValueInt(int iNewValue)
+{
+	return this->writeEEPROMValueIntToAddress(&this->iEEPROMPresentAddress, iNewValue);
+}
+
+bool AcksenIntEEPROM::writeEEPROMValueFloat( float fNewValue)
+{
+	return this->writeEEPROMValueFloatToAddress(&this->iEEPROMPresentAddress, fNewValue);
+}
+
+bool AcksenIntEEPROM::writeEEPROMValueLong(long lNewValue)
+{
+	return this->writeEEPROMValueLongToAddress(&this->iEEPROMPresentAddress, lNewValue);
 }
 
 float AcksenIntEEPROM::readEEPROMValueFloat()
 {
 	float fTemp;
+	uint32_t ulTemp;
 	
 	// Read value from EEPROM
-	fTemp = EEPROM.readFloat(this->iEEPROMPresentAddress);
+	if (this->pPageBackend != NULL)
+	{
+		ulTemp = (uint32_t)this->readPageCache(this->iEEPROMPresentAddress, EEPROM_FLOAT_SIZE);
+		memcpy(&fTemp, &ulTemp, EEPROM_FLOAT_SIZE);
+	}
+	else
+	{
+#if defined(__AVR__)
+		fTemp = EEPROM.readFloat(this->iEEPROMPresentAddress);
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+		fTemp = 0;
+#endif
+	}
 	
 	// Increment Internal EEPROM Address Counter
 	this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_FLOAT_SIZE;
@@ -149,7 +351,20 @@ int AcksenIntEEPROM::readEEPROMValueInt()
 	int iTemp;
 	
 	// Read value from EEPROM
-	iTemp = EEPROM.readInt(this->iEEPROMPresentAddress);
+	if (this->pPageBackend != NULL)
+	{
+		iTemp = (int16_t)this->readPageCache(this->iEEPROMPresentAddress, EEPROM_INT_SIZE);
+	}
+	else
+	{
+#if defined(__AVR__)
+		iTemp = EEPROM.readInt(this->iEEPROMPresentAddress);
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+		iTemp = 0;
+#endif
+	}
 	
 	// Increment Internal EEPROM Address Counter
 	this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_INT_SIZE;
@@ -163,7 +378,20 @@ bool AcksenIntEEPROM::readEEPROMValueBit()
 	bool bTemp;
 	
 	// Read value from EEPROM
-	bTemp = EEPROM.readBit(this->iEEPROMPresentAddress, 0);
+	if (this->pPageBackend != NULL)
+	{
+		bTemp = (this->readPageCache(this->iEEPROMPresentAddress, EEPROM_BYTE_SIZE) & 0x01) != 0;
+	}
+	else
+	{
+#if defined(__AVR__)
+		bTemp = EEPROM.readBit(this->iEEPROMPresentAddress, 0);
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+		bTemp = false;
+#endif
+	}
 	
 	// Increment Internal EEPROM Address Counter
 	this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_BYTE_SIZE;
@@ -177,7 +405,20 @@ long AcksenIntEEPROM::readEEPROMValueLong()
 	long lTemp;
 	
 	// Read value from EEPROM
-	lTemp = EEPROM.readLong(this->iEEPROMPresentAddress);
+	if (this->pPageBackend != NULL)
+	{
+		lTemp = (int32_t)this->readPageCache(this->iEEPROMPresentAddress, EEPROM_LONG_SIZE);
+	}
+	else
+	{
+#if defined(__AVR__)
+		lTemp = EEPROM.readLong(this->iEEPROMPresentAddress);
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+		lTemp = 0;
+#endif
+	}
 	
 	// Increment Internal EEPROM Address Counter
 	this->iEEPROMPresentAddress = this->iEEPROMPresentAddress + EEPROM_LONG_SIZE;
@@ -188,72 +429,132 @@ long AcksenIntEEPROM::readEEPROMValueLong()
 
 bool AcksenIntEEPROM::writeEEPROMValueBitToAddress(int *iEEPROMAddress, bool bNewValue)
 {
+	bool bChanged = false;
+	unsigned long ulByte;
 
-	if (bNewValue != EEPROM.readBit(*iEEPROMAddress, 0))
+	if (this->pPageBackend != NULL)
 	{
-		EEPROM.writeBit(*iEEPROMAddress, 0, bNewValue);
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_BYTE_SIZE;
-		return true;
+		// Page Mode - only bit 0 is used, leave the remaining bits untouched
+		ulByte = this->readPageCache(*iEEPROMAddress, EEPROM_BYTE_SIZE);
+		bChanged = this->writePageCache(*iEEPROMAddress, (ulByte & ~0x01UL) | (bNewValue ? 0x01UL : 0x00UL), EEPROM_BYTE_SIZE);
 	}
 	else
 	{
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_BYTE_SIZE;
-		return false;
+#if defined(__AVR__)
+		if (bNewValue != EEPROM.readBit(*iEEPROMAddress, 0))
+		{
+			EEPROM.writeBit(*iEEPROMAddress, 0, bNewValue);
+			bChanged = true;
+		}
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+#endif
 	}
 
+	*iEEPROMAddress = *iEEPROMAddress + EEPROM_BYTE_SIZE;
+	return bChanged;
+
 }
 
 
 bool AcksenIntEEPROM::writeEEPROMValueIntToAddress(int *iEEPROMAddress, int iNewValue)
 {
+	bool bChanged = false;
 
-	if (iNewValue != EEPROM.readInt(*iEEPROMAddress))
+	if (this->pPageBackend != NULL)
 	{
-		EEPROM.writeInt(*iEEPROMAddress, iNewValue);
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_INT_SIZE;
-		return true;
+		if ((int16_t)iNewValue != iNewValue)
+		{
+			// Value does not fit in EEPROM_INT_SIZE bytes
+			this->bEEPROMError = true;
+		}
+		else
+		{
+			bChanged = this->writePageCache(*iEEPROMAddress, (unsigned long)iNewValue, EEPROM_INT_SIZE);
+		}
 	}
 	else
 	{
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_INT_SIZE;
-		return false;
+#if defined(__AVR__)
+		if (iNewValue != EEPROM.readInt(*iEEPROMAddress))
+		{
+			EEPROM.writeInt(*iEEPROMAddress, iNewValue);
+			bChanged = true;
+		}
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+#endif
 	}
 
+	*iEEPROMAddress = *iEEPROMAddress + EEPROM_INT_SIZE;
+	return bChanged;
 
 }
 
 bool AcksenIntEEPROM::writeEEPROMValueFloatToAddress(int *iEEPROMAddress, float fNewValue)
 {
+	bool bChanged = false;
+	uint32_t ulTemp;
 
-	if (fNewValue != EEPROM.readFloat(*iEEPROMAddress))
+	if (this->pPageBackend != NULL)
 	{
-		EEPROM.writeFloat(*iEEPROMAddress, fNewValue);
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_FLOAT_SIZE;
-		return true;
+		memcpy(&ulTemp, &fNewValue, EEPROM_FLOAT_SIZE);
+		bChanged = this->writePageCache(*iEEPROMAddress, ulTemp, EEPROM_FLOAT_SIZE);
 	}
 	else
 	{
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_FLOAT_SIZE;
-		return false;
+#if defined(__AVR__)
+		if (fNewValue != EEPROM.readFloat(*iEEPROMAddress))
+		{
+			EEPROM.writeFloat(*iEEPROMAddress, fNewValue);
+			bChanged = true;
+		}
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+#endif
 	}
 
+	*iEEPROMAddress = *iEEPROMAddress + EEPROM_FLOAT_SIZE;
+	return bChanged;
+
 }
 
 bool AcksenIntEEPROM::writeEEPROMValueLongToAddress(int *iEEPROMAddress, long lNewValue)
 {
+	bool bChanged = false;
 
-	if (lNewValue != EEPROM.readLong(*iEEPROMAddress))
+	if (this->pPageBackend != NULL)
 	{
-		EEPROM.writeLong(*iEEPROMAddress, lNewValue);
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_LONG_SIZE;
-		return true;
+		if ((int32_t)lNewValue != lNewValue)
+		{
+			// Value does not fit in EEPROM_LONG_SIZE bytes
+			this->bEEPROMError = true;
+		}
+		else
+		{
+			bChanged = this->writePageCache(*iEEPROMAddress, (unsigned long)lNewValue, EEPROM_LONG_SIZE);
+		}
 	}
 	else
 	{
-		*iEEPROMAddress = *iEEPROMAddress + EEPROM_LONG_SIZE;
-		return false;
+#if defined(__AVR__)
+		if (lNewValue != EEPROM.readLong(*iEEPROMAddress))
+		{
+			EEPROM.writeLong(*iEEPROMAddress, lNewValue);
+			bChanged = true;
+		}
+#else
+		// No EEPROM available outside Page Mode
+		this->bEEPROMError = true;
+#endif
 	}
 
+	*iEEPROMAddress = *iEEPROMAddress + EEPROM_LONG_SIZE;
+	return bChanged;
+
 }
 
 void AcksenIntEEPROM::setStartAddress(int iStartAddress)
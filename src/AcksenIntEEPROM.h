@@ -18,8 +18,12 @@ Neither the name of the copyright holder nor the names of its contributors may b
 
 THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ***********************************************************/
-// Acksen Internal EEPROM Library v1.1.0
+// Acksen Internal EEPROM Library v1.2.0
 
+// v1.2.0	19 Oct 2026
+// - Add Page Mode (begin/commit/end) for targets where EEPROM is emulated in flash pages
+// - Add getError/clearError to report reads/writes that could not be performed
+//
 // v1.1.0	25 Jul 2022
 // - Add Button Mode to select between Normal, LongPress or Repeat modes at initialisation
 //
@@ -30,9 +34,13 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 #ifndef AcksenIntEEPROM_h
 #define AcksenIntEEPROM_h
 
-#define AcksenIntEEPROM_ver   110	///< Constant used to set the present library version. Can be used to ensure any code using this library, is correctly updated with necessary changes in subsequent versions, before compilation.
+#define AcksenIntEEPROM_ver   120	///< Constant used to set the present library version. Can be used to ensure any code using this library, is correctly updated with necessary changes in subsequent versions, before compilation.
+
+#include <stdint.h>
 
+#if defined(__AVR__)
 #include <EEPROMex.h>
+#endif
 
 // Constants
 #define EEPROM_LONG_SIZE				4	///< Size of Long variables required in EEPROM memory, in bytes.
@@ -40,6 +48,65 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 #define EEPROM_INT_SIZE					2	///< Size of Int variables required in EEPROM memory, in bytes.
 #define EEPROM_BYTE_SIZE				1	///< Size of Byte variables required in EEPROM memory, in bytes.
 
+/**************************************************************************/
+/*! 
+    @brief  Interface to a flash-emulated EEPROM area, made up of fixed-size pages which must be erased and programmed as a whole.
+            Implement this for the target (or for a simulated backend on the host) and pass it to AcksenIntEEPROM::begin().
+*/
+/**************************************************************************/
+class AcksenIntEEPROMPageBackend
+{
+
+public:
+
+/**************************************************************************/
+/*!
+    @brief  Class destructor.  Virtual, so that backends can be safely deleted through a base class pointer.
+*/
+/**************************************************************************/
+	virtual ~AcksenIntEEPROMPageBackend() {}
+
+/**************************************************************************/
+/*!
+    @brief  Get the size of a single page.
+    @return Page size (in bytes).
+*/
+/**************************************************************************/
+	virtual unsigned int getPageSize() = 0;
+
+/**************************************************************************/
+/*!
+    @brief  Get the number of pages in the emulated EEPROM area.
+    @return Number of pages.
+*/
+/**************************************************************************/
+	virtual unsigned int getPageCount() = 0;
+
+/**************************************************************************/
+/*!
+    @brief  Read a single byte from the stored (committed) contents of the emulated EEPROM area.
+    @param  uiAddress
+            Address to read from (in bytes, from the start of the emulated EEPROM area).
+    @return The stored byte.
+*/
+/**************************************************************************/
+	virtual uint8_t readByte(unsigned int uiAddress) = 0;
+
+/**************************************************************************/
+/*!
+    @brief  Erase and program a whole page.
+    @param  uiPage
+            Index of the page to program.
+    @param  pData
+            Pointer to the new page contents, getPageSize() bytes long.
+    @return True if the page was programmed successfully.
+			False if programming failed.
+*/
+/**************************************************************************/
+	virtual bool programPage(unsigned int uiPage, const uint8_t *pData) = 0;
+
+};
+
 /**************************************************************************/
 /*! 
     @brief  Class that defines the AcksenIntEEPROM state and functions
@@ -60,13 +127,77 @@ public:
 */
 /**************************************************************************/
 	AcksenIntEEPROM(int iStartAddress); 
+
+/**************************************************************************/
+/*!
+    @brief  Class destructor.  Ends Page Mode if active, committing any pending writes.
+            Pending writes that cannot be programmed at this point are lost; call end() first to check.
+*/
+/**************************************************************************/
+	~AcksenIntEEPROM();
+
+/**************************************************************************/
+/*!
+    @brief  Start Page Mode, for targets where EEPROM is emulated in flash pages.
+            The emulated EEPROM area is loaded into a RAM cache, and all subsequent reads/writes use the cache.
+            Written values are only programmed to the backend when commit() or end() is called, once per changed page.
+    @param  pBackend
+            Pointer to the page backend to use.  Must remain valid until end() is called.
+    @return True if Page Mode was started.
+			False if pBackend is NULL, reports a zero page size/count, or the RAM cache could not be allocated.
+			Also False if a previous Page Mode session could not be ended (see end()), in which case that session is left active.
+    @note   Addresses are measured from the start of the emulated EEPROM area.  Reads/writes outside the area are not
+            performed, and set the error flag (see getError()).
+*/
+/**************************************************************************/
+	bool begin(AcksenIntEEPROMPageBackend *pBackend);
+
+/**************************************************************************/
+/*!
+    @brief  Program all pages written since begin() or the last commit(), skipping any whose contents are unchanged from the backend.
+    @return True if all changed pages were programmed successfully (or nothing needed programming).
+			False if Page Mode is not active, or if programming any page failed.  Failed pages remain pending.
+*/
+/**************************************************************************/
+	bool commit();
+
+/**************************************************************************/
+/*!
+    @brief  Commit any pending writes, then leave Page Mode and release the RAM cache.
+            If the final commit() fails, Page Mode stays active with the RAM cache intact, so that end() or commit() can be retried.
+    @return True if Page Mode was ended, or was not active.
+			False if the final commit() failed.
+*/
+/**************************************************************************/
+	bool end();
+
+/**************************************************************************/
+/*!
+    @brief  Get the error flag.  This is set when a read/write could not be performed, and remains set until clearError() is called.
+            A read/write fails if it falls outside the emulated EEPROM area in Page Mode, if an Int/Long value does not fit in
+            its stored size in Page Mode, or if Page Mode is not active on a target without AVR internal EEPROM.
+            A failed write is not stored and returns False; a failed read returns 0.
+    @return True if a read/write has failed since the flag was last cleared.
+			False otherwise.
+*/
+/**************************************************************************/
+	bool getError();
+
+/**************************************************************************/
+/*!
+    @brief  Clear the error flag.
+    @return No return value.
+*/
+/**************************************************************************/
+	void clearError();
 	
 /**************************************************************************/
 /*!
     @brief  Write a Float value to EEPROM, using the current Memory Address.  The Memory Address will be incremented after writing.
     @param  fNewValue
             The value to be written to the Present Memory Address.
-    @return No return value.
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueFloat(float fNewValue);
@@ -75,8 +206,10 @@ public:
 /*!
     @brief  Write an Int value to EEPROM, using the current Memory Address.  The Memory Address will be incremented after writing.
     @param  iNewValue
-            The value to be written to the Present Memory Address.
-    @return No return value.
+            The value to be written to the Present Memory Address.  Stored as 16 bits (EEPROM_INT_SIZE); in Page Mode, values outside
+            -32768..32767 are not written and set the error flag (see getError()).
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueInt(int iNewValue);
@@ -86,7 +219,8 @@ public:
     @brief  Write a Bit/Bool value to EEPROM, using the current Memory Address.  The Memory Address will be incremented after writing.
     @param  bNewValue
             The value to be written to the Present Memory Address.
-    @return No return value.
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueBit(bool bNewValue);
@@ -95,8 +229,10 @@ public:
 /*!
     @brief  Write a Long value to EEPROM, using the current Memory Address.  The Memory Address will be incremented after writing.
     @param  lNewValue
-            The value to be written to the Present Memory Address.
-    @return No return value.
+            The value to be written to the Present Memory Address.  Stored as 32 bits (EEPROM_LONG_SIZE); in Page Mode, values outside
+            -2147483648..2147483647 are not written and set the error flag (see getError()).
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueLong(long lNewValue);
@@ -140,7 +276,8 @@ public:
             Pointer to the Memory Address to write to.  It will be incremented to the new Memory Address after writing.
     @param  fNewValue
             The value to be written.
-    @return No return value.
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueFloatToAddress(int *iEEPROMAddress, float fNewValue);
@@ -151,8 +288,10 @@ public:
     @param  *iEEPROMAddress
             Pointer to the Memory Address to write to.  It will be incremented to the new Memory Address after writing.
     @param  iNewValue
-            The value to be written.
-    @return No return value.
+            The value to be written.  Stored as 16 bits (EEPROM_INT_SIZE); in Page Mode, values outside
+            -32768..32767 are not written and set the error flag (see getError()).
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueIntToAddress(int *iEEPROMAddress, int iNewValue);
@@ -164,7 +303,8 @@ public:
             Pointer to the Memory Address to write to.  It will be incremented to the new Memory Address after writing.
     @param  bNewValue
             The value to be written.
-    @return No return value.
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueBitToAddress(int *iEEPROMAddress, bool bNewValue);
@@ -175,8 +315,10 @@ public:
     @param  *iEEPROMAddress
             Pointer to the Memory Address to write to.  It will be incremented to the new Memory Address after writing.
     @param  lNewValue
-            The value to be written.
-    @return No return value.
+            The value to be written.  Stored as 32 bits (EEPROM_LONG_SIZE); in Page Mode, values outside
+            -2147483648..2147483647 are not written and set the error flag (see getError()).
+    @return True if the stored value was changed.
+			False if it was already stored, or the write failed (see getError()).
 */
 /**************************************************************************/
 	bool writeEEPROMValueLongToAddress(int *iEEPROMAddress, long lNewValue);
@@ -296,6 +438,60 @@ protected:
   
 	int iEEPROMStartAddress;	///< Starting Memory Address for EEPROM data
 	int iEEPROMPresentAddress;	///< Present Memory Address used for reading/writing EEPROM data
+
+	AcksenIntEEPROMPageBackend *pPageBackend;	///< Page backend used in Page Mode, or NULL when writing directly to EEPROM
+	uint8_t *pPageCache;	///< RAM cache of the whole emulated EEPROM area, used in Page Mode
+	uint8_t *pDirtyPages;	///< Bitmap of pages written since the last commit, used in Page Mode
+	unsigned int uiPageSize;	///< Page size (in bytes), used in Page Mode
+	unsigned int uiPageCount;	///< Number of pages, used in Page Mode
+
+	bool bEEPROMError;	///< Set when a read/write could not be performed, until cleared by clearError()
+
+/**************************************************************************/
+/*!
+    @brief  Check that a read/write lies wholly within the Page Mode RAM cache.
+    @param  iAddress
+            Address of the first byte (in bytes, from the start of the emulated EEPROM area).
+    @param  iSize
+            Number of bytes to be read/written.
+    @return True if the whole range is within the cache.
+			False otherwise.
+*/
+/**************************************************************************/
+	bool isPageCacheRange(int iAddress, int iSize);
+
+/**************************************************************************/
+/*!
+    @brief  Write a value to the Page Mode RAM cache, least significant byte first, marking any changed pages as dirty.
+    @param  iAddress
+            Address to write to (in bytes, from the start of the emulated EEPROM area).
+    @param  ulValue
+            The value to be written.  Only the lowest iSize bytes are stored.
+    @param  iSize
+            Number of bytes to write.
+    @return True if the cached value was changed.
+			False if it was unchanged, or the range was outside the cache (which also sets the error flag).
+*/
+/**************************************************************************/
+	bool writePageCache(int iAddress, unsigned long ulValue, int iSize);
+
+/**************************************************************************/
+/*!
+    @brief  Read a value from the Page Mode RAM cache, least significant byte first.
+    @param  iAddress
+            Address to read from (in bytes, from the start of the emulated EEPROM area).
+    @param  iSize
+            Number of bytes to read.
+    @return The value read, or 0 if the range was outside the cache (which also sets the error flag).
+*/
+/**************************************************************************/
+	unsigned long readPageCache(int iAddress, int iSize);
+
+private:
+
+	// Not copyable, as the Page Mode cache buffers are owned by this object
+	AcksenIntEEPROM(const AcksenIntEEPROM &);
+	AcksenIntEEPROM &operator=(const AcksenIntEEPROM &);
 };
 
 #endif
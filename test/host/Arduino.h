@@ -0,0 +1,10 @@
+// Minimal Arduino.h shim, allowing AcksenIntEEPROM to be built and tested on the host.
+// Only Page Mode is available, as there is no AVR internal EEPROM.
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#endif
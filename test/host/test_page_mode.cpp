@@ -0,0 +1,318 @@
+/***********************************************************
+Host test for AcksenIntEEPROM Page Mode.
+
+Uses a simulated page-erase backend held in RAM, which counts page
+erase/program cycles, to check that writes are batched per page.
+
+Usage: make -C test/host check
+***********************************************************/
+
+#include "AcksenIntEEPROM.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+// ***********************************
+// Constants
+// ***********************************
+#define SIM_PAGE_SIZE		64	// Simulated flash page size, in bytes
+#define SIM_PAGE_COUNT		4	// Simulated flash page count
+
+// ***********************************
+// Simulated Page Backend
+// ***********************************
+class SimulatedPageBackend : public AcksenIntEEPROMPageBackend
+{
+
+public:
+
+	SimulatedPageBackend()
+	{
+		memset(this->ucFlash, 0xFF, sizeof(this->ucFlash));	// Erased flash
+		this->uiPageSize = SIM_PAGE_SIZE;
+		this->uiPageCount = SIM_PAGE_COUNT;
+		this->uiPageCycles = 0;
+		this->bFailProgram = false;
+	}
+
+	unsigned int getPageSize() { return this->uiPageSize; }
+	unsigned int getPageCount() { return this->uiPageCount; }
+	uint8_t readByte(unsigned int uiAddress) { return this->ucFlash[uiAddress]; }
+
+	bool programPage(unsigned int uiPage, const uint8_t *pData)
+	{
+		if (this->bFailProgram == true)
+		{
+			return false;
+		}
+
+		memcpy(&this->ucFlash[uiPage * SIM_PAGE_SIZE], pData, SIM_PAGE_SIZE);
+		this->uiPageCycles++;
+		return true;
+	}
+
+	uint8_t ucFlash[SIM_PAGE_SIZE * SIM_PAGE_COUNT];	// Simulated flash contents
+	unsigned int uiPageSize;	// Reported page size
+	unsigned int uiPageCount;	// Reported page count
+	unsigned int uiPageCycles;	// Number of page erase/program cycles performed
+	bool bFailProgram;	// Set to make programPage() fail
+
+};
+
+// ***********************************
+// Test Helpers
+// ***********************************
+static int iFailures = 0;
+
+#define CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+			iFailures++; \
+		} \
+	} while (0)
+
+// ************************************************
+// Tests
+// ************************************************
+static void testBatchedCommit()
+{
+	SimulatedPageBackend SimBackend;
+	AcksenIntEEPROM IntEEPROM(8);
+
+	CHECK(IntEEPROM.begin(&SimBackend) == true);
+
+	// Several writes to one page only cost a single cycle, and only on commit
+	CHECK(IntEEPROM.writeEEPROMValueBit(false) == true);
+	CHECK(IntEEPROM.writeEEPROMValueInt(-1234) == true);
+	CHECK(IntEEPROM.writeEEPROMValueLong(-3423423) == true);
+	CHECK(IntEEPROM.writeEEPROMValueFloat(3.14159f) == true);
+	CHECK(SimBackend.uiPageCycles == 0);
+
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+
+	// Nothing pending, so nothing to program
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+
+	// Rewriting the same values is reported as unchanged
+	IntEEPROM.resetPresentAddress();
+	CHECK(IntEEPROM.writeEEPROMValueBit(false) == false);
+	CHECK(IntEEPROM.writeEEPROMValueInt(-1234) == false);
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+
+	// Values read back, from the cache and from a fresh session on the stored contents
+	IntEEPROM.resetPresentAddress();
+	CHECK(IntEEPROM.readEEPROMValueBit() == false);
+	CHECK(IntEEPROM.readEEPROMValueInt() == -1234);
+	CHECK(IntEEPROM.readEEPROMValueLong() == -3423423);
+	CHECK(IntEEPROM.readEEPROMValueFloat() == 3.14159f);
+	CHECK(IntEEPROM.end() == true);
+
+	AcksenIntEEPROM IntEEPROMReload(8);
+	CHECK(IntEEPROMReload.begin(&SimBackend) == true);
+	CHECK(IntEEPROMReload.readEEPROMValueBit() == false);
+	CHECK(IntEEPROMReload.readEEPROMValueInt() == -1234);
+	CHECK(IntEEPROMReload.readEEPROMValueLong() == -3423423);
+	CHECK(IntEEPROMReload.readEEPROMValueFloat() == 3.14159f);
+	CHECK(IntEEPROMReload.getError() == false);
+}
+
+static void testUnchangedPageSkipped()
+{
+	SimulatedPageBackend SimBackend;
+	AcksenIntEEPROM IntEEPROM(0);
+	int iAddress;
+
+	CHECK(IntEEPROM.begin(&SimBackend) == true);
+
+	// Change a value, then write its original contents back - the page is dirty but unchanged
+	iAddress = 70;
+	CHECK(IntEEPROM.writeEEPROMValueLongToAddress(&iAddress, 42) == true);
+	iAddress = 70;
+	CHECK(IntEEPROM.writeEEPROMValueLongToAddress(&iAddress, -1) == true);	// Erased flash is 0xFFFFFFFF
+
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 0);
+}
+
+static void testValueSpanningPages()
+{
+	SimulatedPageBackend SimBackend;
+	AcksenIntEEPROM IntEEPROM(0);
+	int iAddress;
+
+	CHECK(IntEEPROM.begin(&SimBackend) == true);
+
+	// A Long at the end of page 0 runs into page 1, so both are programmed once
+	iAddress = SIM_PAGE_SIZE - 2;
+	CHECK(IntEEPROM.writeEEPROMValueLongToAddress(&iAddress, 0x12345678L) == true);
+	CHECK(iAddress == SIM_PAGE_SIZE + 2);
+
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 2);
+
+	// Stored least significant byte first
+	CHECK(SimBackend.ucFlash[SIM_PAGE_SIZE - 2] == 0x78);
+	CHECK(SimBackend.ucFlash[SIM_PAGE_SIZE - 1] == 0x56);
+	CHECK(SimBackend.ucFlash[SIM_PAGE_SIZE] == 0x34);
+	CHECK(SimBackend.ucFlash[SIM_PAGE_SIZE + 1] == 0x12);
+
+	IntEEPROM.setPresentAddress(SIM_PAGE_SIZE - 2);
+	CHECK(IntEEPROM.readEEPROMValueLong() == 0x12345678L);
+}
+
+static void testFailedProgramStaysPending()
+{
+	SimulatedPageBackend SimBackend;
+	AcksenIntEEPROM IntEEPROM(0);
+
+	CHECK(IntEEPROM.begin(&SimBackend) == true);
+	CHECK(IntEEPROM.writeEEPROMValueInt(34) == true);
+
+	// Programming fails, so the page must stay pending
+	SimBackend.bFailProgram = true;
+	CHECK(IntEEPROM.commit() == false);
+	CHECK(SimBackend.uiPageCycles == 0);
+	CHECK(SimBackend.ucFlash[0] == 0xFF);
+
+	// Retried on the next commit
+	SimBackend.bFailProgram = false;
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+	CHECK(SimBackend.ucFlash[0] == 34);
+
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+}
+
+static void testFailedEndStaysActive()
+{
+	SimulatedPageBackend SimBackend;
+	SimulatedPageBackend SimBackendOther;
+	AcksenIntEEPROM IntEEPROM(0);
+
+	CHECK(IntEEPROM.begin(&SimBackend) == true);
+	CHECK(IntEEPROM.writeEEPROMValueInt(34) == true);
+
+	// end() cannot commit, so Page Mode stays active with the write still pending
+	SimBackend.bFailProgram = true;
+	CHECK(IntEEPROM.end() == false);
+	IntEEPROM.resetPresentAddress();
+	CHECK(IntEEPROM.readEEPROMValueInt() == 34);
+	CHECK(IntEEPROM.getError() == false);
+
+	// Starting another session is refused, and leaves the existing one untouched
+	CHECK(IntEEPROM.begin(&SimBackendOther) == false);
+	IntEEPROM.resetPresentAddress();
+	CHECK(IntEEPROM.readEEPROMValueInt() == 34);
+	CHECK(SimBackendOther.ucFlash[0] == 0xFF);
+
+	// Once programming succeeds, the retried end() commits the pending write
+	SimBackend.bFailProgram = false;
+	CHECK(IntEEPROM.end() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+	CHECK(SimBackend.ucFlash[0] == 34);
+	CHECK(IntEEPROM.commit() == false);	// Page Mode no longer active
+
+	CHECK(IntEEPROM.begin(&SimBackendOther) == true);
+	CHECK(IntEEPROM.end() == true);
+}
+
+static void testOutOfRange()
+{
+	SimulatedPageBackend SimBackend;
+	AcksenIntEEPROM IntEEPROM(0);
+	int iAddress;
+
+	CHECK(IntEEPROM.begin(&SimBackend) == true);
+	CHECK(IntEEPROM.getError() == false);
+
+	// Address past the end of the emulated area
+	iAddress = (SIM_PAGE_SIZE * SIM_PAGE_COUNT) - 2;
+	CHECK(IntEEPROM.writeEEPROMValueLongToAddress(&iAddress, 1) == false);
+	CHECK(IntEEPROM.getError() == true);
+	IntEEPROM.clearError();
+
+	// Negative address, and a large address where the bounds check must not overflow
+	iAddress = -1;
+	CHECK(IntEEPROM.writeEEPROMValueBitToAddress(&iAddress, true) == false);
+	CHECK(IntEEPROM.getError() == true);
+	IntEEPROM.clearError();
+
+	IntEEPROM.setPresentAddress(INT_MAX - 8);
+	CHECK(IntEEPROM.readEEPROMValueLong() == 0);
+	CHECK(IntEEPROM.getError() == true);
+	IntEEPROM.clearError();
+
+	// Values too wide for their stored size are rejected, not truncated
+	iAddress = 0;
+	CHECK(IntEEPROM.writeEEPROMValueIntToAddress(&iAddress, 70000) == false);
+	CHECK(IntEEPROM.getError() == true);
+	IntEEPROM.clearError();
+
+#if LONG_MAX > 0x7FFFFFFFL
+	iAddress = 0;
+	CHECK(IntEEPROM.writeEEPROMValueLongToAddress(&iAddress, 0x80000000L) == false);
+	CHECK(IntEEPROM.getError() == true);
+	IntEEPROM.clearError();
+#endif
+
+	iAddress = 0;
+	CHECK(IntEEPROM.writeEEPROMValueIntToAddress(&iAddress, -32768) == true);
+	CHECK(IntEEPROM.getError() == false);
+
+	CHECK(IntEEPROM.commit() == true);
+	CHECK(SimBackend.uiPageCycles == 1);
+}
+
+static void testBeginRejected()
+{
+	SimulatedPageBackend SimBackend;
+	AcksenIntEEPROM IntEEPROM(0);
+
+	CHECK(IntEEPROM.begin(NULL) == false);
+
+	SimBackend.uiPageSize = 0;
+	CHECK(IntEEPROM.begin(&SimBackend) == false);
+
+	SimBackend.uiPageSize = SIM_PAGE_SIZE;
+	SimBackend.uiPageCount = 0;
+	CHECK(IntEEPROM.begin(&SimBackend) == false);
+
+	// Without Page Mode there is no EEPROM on the host, so reads/writes report an error
+	CHECK(IntEEPROM.commit() == false);
+	CHECK(IntEEPROM.writeEEPROMValueInt(1) == false);
+	CHECK(IntEEPROM.getError() == true);
+	IntEEPROM.clearError();
+	CHECK(IntEEPROM.readEEPROMValueInt() == 0);
+	CHECK(IntEEPROM.getError() == true);
+}
+
+// ************************************************
+// Main
+// ************************************************
+int main()
+{
+	testBatchedCommit();
+	testUnchangedPageSkipped();
+	testValueSpanningPages();
+	testFailedProgramStaysPending();
+	testFailedEndStaysActive();
+	testOutOfRange();
+	testBeginRejected();
+
+	if (iFailures != 0)
+	{
+		printf("%d check(s) failed\n", iFailures);
+		return 1;
+	}
+
+	printf("All checks passed\n");
+	return 0;
+}